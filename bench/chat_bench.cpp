@@ -0,0 +1,129 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../include/chat_room.hpp"
+
+/**
+@file chat_bench.cpp
+in-process microbenchmarks of the message codec and the room fan-out
+*/
+
+/// accumulator that keeps benchmarked code from being optimized out
+static volatile size_t sink = 0;
+
+/**
+@function run
+runs function iters times and prints average time of one call
+@param name is benchmark name
+@param iters is number of iterations
+@param f is benchmarked function
+*/
+template <typename F>
+void run(const std::string &name, long iters, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iters; ++i) {
+        f();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << ns / iters << " ns/op\n";
+}
+
+/**
+@class mock_participant
+participant that only touches delivered message
+*/
+class mock_participant : public chat_participant {
+public:
+    /// counts delivered message length
+    void deliver(const chat_message &msg) {
+        sink = sink + msg.length();
+    }
+};
+
+/**
+@class queue_participant
+participant that queues and dequeues delivered message as chat_session does
+*/
+class queue_participant : public chat_participant {
+public:
+    /// copies message to the queue and pops it
+    void deliver(const chat_message &msg) {
+        msgs_.push_back(msg);
+        sink = sink + msgs_.front().length();
+        msgs_.pop_front();
+    }
+
+private:
+    /// message queue
+    std::deque<chat_message> msgs_;
+};
+
+//----------------------------------------------------------------------
+
+/// benchmarks header encoding and decoding
+void bench_codec() {
+    chat_message msg = create_msg("hello, world", "alice", MESSAGE);
+    run("encode_header", 10000000, [&msg]() {
+        msg.encode_header();
+        sink = sink + msg.data()[3];
+    });
+    run("decode_header", 10000000, [&msg]() {
+        sink = sink + msg.decode_header();
+    });
+
+    std::string body(chat_message::max_body_length, 'x');
+    run("create_msg (12 byte body)", 5000000, []() {
+        sink = sink + create_msg("hello, world", "alice", MESSAGE).length();
+    });
+    run("create_msg (1024 byte body)", 2000000, [&body]() {
+        sink = sink + create_msg(body.c_str(), "alice", MESSAGE).length();
+    });
+}
+
+/// benchmarks room broadcast for different participants count
+template <typename P>
+void bench_fan_out(const std::string &name) {
+    chat_message msg = create_msg("hello, world", "alice", MESSAGE);
+    for (int n: {1, 10, 100, 1000}) {
+        chat_room room;
+        std::vector<std::shared_ptr<P> > ps;
+        for (int i = 0; i < n; ++i) {
+            ps.push_back(std::make_shared<P>());
+            room.join(ps.back());
+        }
+        run(name + " deliver, " + std::to_string(n) + " participants", 10000000 / n, [&room, &msg]() {
+            room.deliver(msg);
+        });
+    }
+}
+
+/// benchmarks nickname query of a new participant with full history replay
+void bench_history() {
+    chat_room room;
+    for (int i = 0; i < 100; ++i) {
+        room.deliver(create_msg("hello, world", "alice", MESSAGE));
+    }
+    auto p = std::make_shared<queue_participant>();
+    chat_message query = create_msg("", "bob", QUERY);
+    run("is_available with history replay", 200000, [&room, &p, &query]() {
+        room.join(p);
+        sink = sink + room.is_available(query, p);
+        room.leave(p);
+    });
+}
+
+//----------------------------------------------------------------------
+
+/**
+@function main
+runs all benchmarks
+*/
+int main() {
+    bench_codec();
+    bench_fan_out<mock_participant>("mock");
+    bench_fan_out<queue_participant>("queue");
+    bench_history();
+    return 0;
+}
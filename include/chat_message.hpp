@@ -130,7 +130,7 @@ public:
     /// method encodes message body and nickname parts length
     void encode_header() {
         char header[header_length + 1] = "";
-        std::sprintf(header, "%04d%02d", body_length_, nick_length_);
+        std::sprintf(header, "%04d%02d", static_cast<int>(body_length_), static_cast<int>(nick_length_));
         std::memcpy(data_, header, header_length);
     }
 
@@ -150,7 +150,7 @@ creates new message to deliver from the message, the nickname and message type
 @param nick is c string that stores nickname
 @param type is message type
 */
-chat_message create_msg(const char *line, const char *nick, msg_type type) {
+inline chat_message create_msg(const char *line, const char *nick, msg_type type) {
     chat_message msg;
     msg.body_length(std::strlen(line));
     msg.nick_length(std::strlen(nick));
@@ -159,4 +159,4 @@ chat_message create_msg(const char *line, const char *nick, msg_type type) {
     std::memcpy(msg.nick(), nick, msg.nick_length());
     msg.encode_header();
     return msg;
-}
\ No newline at end of file
+}
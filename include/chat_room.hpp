@@ -0,0 +1,99 @@
+#pragma once
+#include <deque>
+#include <memory>
+#include <set>
+#include <map>
+#include <string>
+#include <utility>
+#include "chat_message.hpp"
+
+/**
+@file chat_room.hpp
+room and participant interfaces
+*/
+
+/** 
+@class chat_participant
+abstract class of messenger participant that allows to deliver message to participant
+*/
+class chat_participant {
+public:
+  /// destructor
+  /// virtual destructor
+    virtual ~chat_participant() {}
+
+    /// method allows message sending to participant
+    /// @param msg is message to sent
+    virtual void deliver(const chat_message& msg) = 0;
+};
+
+//----------------------------------------------------------------------
+
+/**
+@class chat_room
+room stores all messenger participants as shared pointers to them
+and also stores nicknames and map from participant to it's nickname  
+*/
+class chat_room {
+public:
+  /// method adds new participant to the room
+  /// @param participant is pointer to new messenger participant
+    void join(std::shared_ptr<chat_participant> participant) {
+      participants_.insert(participant);
+    }
+
+    /// method removes the participant from the room
+    /// it frees its pointer and removes nickname
+    /// @param participant is pointer to the participant to remove
+    void leave(std::shared_ptr<chat_participant> participant) {
+      auto it = nickname_map_.find(participant);
+      if (it != nickname_map_.end()) {
+        nicknames_.erase(it->second);
+        nickname_map_.erase(it);
+      }
+      participants_.erase(participant);
+    }
+
+    /// method broadcast message to all room participants
+    /// @param msg is message to broadcast
+    void deliver(const chat_message &msg) {
+      recent_msgs_.push_back(msg);
+      while (recent_msgs_.size() > max_recent_msgs) {
+          recent_msgs_.pop_front();
+        }
+
+      for (auto participant: participants_) {
+          participant->deliver(msg);
+        }
+    }
+
+    /// method checks for nickname availability and if it is then
+    /// stores new nickname and associates participant with its nickname
+    /// also method sends recent messenger history to the new assigned participant
+    /// @param msg is message that stores nickname
+    /// @param participant is participant to associate nickname with
+    bool is_available(const chat_message &msg, const std::shared_ptr<chat_participant> &participant) {
+      char nick_[chat_message::max_nick_length + 1] = "";
+      std::strncat(nick_, msg.nick(), msg.nick_length());
+      std::string nick = std::string(nick_);
+      if (nicknames_.find(nick) != nicknames_.end()) { return false; }
+      nicknames_.insert(nick);
+      nickname_map_.insert(std::make_pair(participant, nick));
+      for (auto msg: recent_msgs_) {
+          participant->deliver(msg);
+        }
+      return true;
+    }
+
+private:
+    /// constant that defines maximum messenger history size
+    static const size_t max_recent_msgs = 100;
+    /// set of room participants
+    std::set<std::shared_ptr<chat_participant> > participants_;
+    /// set of room nicknames
+    std::set<std::string> nicknames_;
+    /// map from the participant to it's nickname
+    std::map<std::shared_ptr<chat_participant>, std::string> nickname_map_;
+    /// container of room messages
+    std::deque<chat_message> recent_msgs_;
+};
@@ -0,0 +1,120 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include "../include/chat_message.hpp"
+
+/**
+@file tcpbench.cpp
+Messenger server load generator, used to compare server i/o backends
+*/
+
+using boost::asio::ip::tcp;
+
+/**
+@function read_run_msgs
+reads messages from the socket until count messages of the current run are received
+(messages of other nicknames, e.g. room history, are skipped)
+@param socket is connected socket to read from
+@param nick is nickname of the current run sender
+@param count is number of messages to wait for
+*/
+void read_run_msgs(tcp::socket &socket, const std::string &nick, int count) {
+    chat_message msg;
+    int received = 0;
+    while (received < count) {
+        boost::asio::read(socket, boost::asio::buffer(msg.data(),
+            chat_message::header_length + chat_message::type_length + chat_message::max_nick_length));
+        if (!msg.decode_header()) {
+            throw std::runtime_error("malformed message header");
+        }
+        boost::asio::read(socket, boost::asio::buffer(msg.body(), msg.body_length()));
+        if (*(msg.type()) == MESSAGE && msg.nick_length() == nick.size()
+            && !std::memcmp(msg.nick(), nick.data(), nick.size())) {
+            ++received;
+        }
+    }
+}
+
+//----------------------------------------------------------------------
+
+/**
+@function main
+connects clients to the server, sends messages from one of them
+and measures time until every client receives all of them
+@param argv is tcpbench <host> <port> <clients> <messages>
+*/
+int main(int argc, char* argv[]) {
+    try {
+        if (argc != 5) {
+            std::cerr << "Usage: tcpbench <host> <port> <clients> <messages>\n";
+            return 1;
+        }
+
+        int clients = std::atoi(argv[3]);
+        int messages = std::atoi(argv[4]);
+        if (clients < 1 || messages < 1) {
+            std::cerr << "clients and messages must be positive\n";
+            return 1;
+        }
+
+        boost::asio::io_service io_service;
+        tcp::resolver resolver(io_service);
+        auto endpoint_iterator = resolver.resolve({ argv[1], argv[2] });
+
+        std::vector<std::unique_ptr<tcp::socket> > sockets;
+        for (int i = 0; i < clients; ++i) {
+            sockets.emplace_back(new tcp::socket(io_service));
+            boost::asio::connect(*sockets.back(), endpoint_iterator);
+            sockets.back()->set_option(tcp::no_delay(true));
+        }
+        // let the server join all sessions to the room before sending
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        std::string nick = "bench" + std::to_string(
+            std::chrono::steady_clock::now().time_since_epoch().count() % 100000000);
+        std::string body(64, 'x');
+
+        std::atomic<int> failed(0);
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < clients; ++i) {
+            tcp::socket &socket = *sockets[i];
+            readers.emplace_back([&socket, &nick, messages, &failed]() {
+                try {
+                    read_run_msgs(socket, nick, messages);
+                } catch (std::exception &e) {
+                    std::cerr << "Reader exception: " << e.what() << "\n";
+                    ++failed;
+                }
+            });
+        }
+
+        chat_message msg = create_msg(body.c_str(), nick.c_str(), MESSAGE);
+        for (int i = 0; i < messages; ++i) {
+            boost::asio::write(*sockets[0], boost::asio::buffer(msg.data(), msg.length()));
+        }
+
+        for (auto &t: readers) { t.join(); }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (failed) { return 1; }
+
+        double delivered = static_cast<double>(clients) * messages;
+        std::cout << "clients: " << clients << ", messages: " << messages
+                  << ", elapsed: " << elapsed << " s, delivered: "
+                  << static_cast<long long>(delivered / elapsed) << " msg/s\n";
+    }
+    catch (std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,11 +1,15 @@
 #include <iostream>
 #include <deque>
 #include <memory>
-#include <set>
-#include <map>
 #include <utility>
+#include <vector>
 #include <boost/asio.hpp>
-#include "../include/chat_message.hpp"
+#include <boost/version.hpp>
+#include "../include/chat_room.hpp"
+
+#if defined(BOOST_ASIO_HAS_IO_URING) && BOOST_VERSION < 107800
+#error "io_uring backend requires Boost 1.78 or newer"
+#endif
 
 /**
 @mainpage Multicast Messenger
@@ -18,93 +22,6 @@ Messenger server implementation
 
 using boost::asio::ip::tcp;
 
-/** 
-@class chat_participant
-abstract class of messenger participant that allows to deliver message to participant
-*/
-class chat_participant {
-public:
-  /// destructor
-  /// virtual destructor
-    virtual ~chat_participant() {}
-
-    /// method allows message sending to participant
-    /// @param msg is message to sent
-    virtual void deliver(const chat_message& msg) = 0;
-};
-
-//----------------------------------------------------------------------
-
-/**
-@class chat_room
-room stores all messenger participants as shared pointers to them
-and also stores nicknames and map from participant to it's nickname  
-*/
-class chat_room {
-public:
-  /// method adds new participant to the room
-  /// @param participant is pointer to new messenger participant
-    void join(std::shared_ptr<chat_participant> participant) {
-      participants_.insert(participant);
-    }
-
-    /// method removes the participant from the room
-    /// it frees its pointer and removes nickname
-    /// @param participant is pointer to the participant to remove
-    void leave(std::shared_ptr<chat_participant> participant) {
-      auto it = nickname_map_.find(participant);
-      auto its = nicknames_.find(it->second);
-      if (its != nicknames_.end()) { nicknames_.erase(its); }
-      if (it != nickname_map_.end()) { nickname_map_.erase(it); }
-      participants_.erase(participant);
-    }
-
-    /// method broadcast message to all room participants
-    /// @param msg is message to broadcast
-    void deliver(const chat_message &msg) {
-      recent_msgs_.push_back(msg);
-      while (recent_msgs_.size() > max_recent_msgs) {
-          recent_msgs_.pop_front();
-        }
-
-      for (auto participant: participants_) {
-          participant->deliver(msg);
-        }
-    }
-
-    /// method checks for nickname availability and if it is then
-    /// stores new nickname and associates participant with its nickname
-    /// also method sends recent messenger history to the new assigned participant
-    /// @param msg is message that stores nickname
-    /// @param participant is participant to associate nickname with
-    bool is_available(const chat_message &msg, const std::shared_ptr<chat_participant> &participant) {
-      char nick_[chat_message::max_nick_length + 1] = "";
-      std::strncat(nick_, msg.nick(), msg.nick_length());
-      std::string nick = std::string(nick_);
-      if (nicknames_.find(nick) != nicknames_.end()) { return false; }
-      nicknames_.insert(nick);
-      nickname_map_.insert(std::make_pair(participant, nick));
-      for (auto msg: recent_msgs_) {
-          participant->deliver(msg);
-        }
-      return true;
-    }
-
-private:
-    /// constant that defines maximum messenger history size
-    static const size_t max_recent_msgs = 100;
-    /// set of room participants
-    std::set<std::shared_ptr<chat_participant> > participants_;
-    /// set of room nicknames
-    std::set<std::string> nicknames_;
-    /// map from the participant to it's nickname
-    std::map<std::shared_ptr<chat_participant>, std::string> nickname_map_;
-    /// container of room messages
-    std::deque<chat_message> recent_msgs_;
-};
-
-//----------------------------------------------------------------------
-
 /**
 @class chat_session
 inherit from chat_participant, implements connecting, reading and writing messages;
@@ -136,35 +53,23 @@ public:
     }
 
 private:
-    /// method starts reading from message header if something is in the socket
-    /// if header is read then method starts reading nickname
+    /// method starts reading message header together with type and nickname
+    /// (all of them have fixed length) so only one read is issued for them;
+    /// if header is valid then method starts reading message body
     void do_read_header() {
       auto self(shared_from_this());
       boost::asio::async_read(socket_,
-          boost::asio::buffer(read_msg_.data(), chat_message::header_length + chat_message::type_length),
+          boost::asio::buffer(read_msg_.data(),
+            chat_message::header_length + chat_message::type_length + chat_message::max_nick_length),
           [this, self](boost::system::error_code ec, std::size_t /*length*/) {
               if (!ec && read_msg_.decode_header()) {
-                do_read_nick();
+                do_read_body();
               } else {
                 room_.leave(shared_from_this());
               }
           });
     }
 
-    /// method continues reading by reading nickname from the socket
-    /// if nickname is read the method starts reading message body
-    void do_read_nick() {
-        boost::asio::async_read(socket_,
-            boost::asio::buffer(read_msg_.nick(), chat_message::max_nick_length),
-            [this](boost::system::error_code ec, std::size_t /*length*/) {
-                if (!ec) {
-                    do_read_body();
-                } else {
-                    socket_.close();
-                }
-            });
-    }
-
     /// method implements the last reading part of the message
     /// if body is read method analyzes message type; if message is ususal
     /// then it is sent to all room participants, if message type is query 
@@ -197,15 +102,19 @@ private:
           });
     }
 
-    /// method writes message to the socket
+    /// method writes all queued messages (up to max_write_batch) to the socket
+    /// with a single gather write
     void do_write() {
       auto self(shared_from_this());
-      boost::asio::async_write(socket_,
-          boost::asio::buffer(write_msgs_.front().data(),
-            write_msgs_.front().length()),
-          [this, self](boost::system::error_code ec, std::size_t /*length*/) {
+      std::size_t batch = write_msgs_.size() < max_write_batch ? write_msgs_.size() : max_write_batch;
+      write_bufs_.clear();
+      for (std::size_t i = 0; i < batch; ++i) {
+          write_bufs_.push_back(boost::asio::buffer(write_msgs_[i].data(), write_msgs_[i].length()));
+        }
+      boost::asio::async_write(socket_, write_bufs_,
+          [this, self, batch](boost::system::error_code ec, std::size_t /*length*/) {
               if (!ec) {
-                write_msgs_.pop_front();
+                write_msgs_.erase(write_msgs_.begin(), write_msgs_.begin() + batch);
                 if (!write_msgs_.empty()) {
                     do_write();
                   }
@@ -215,6 +124,8 @@ private:
           });
     }
 
+    /// constant that defines maximum number of messages sent by one write
+    static const std::size_t max_write_batch = 64;
     /// i/o socket of the participant
     tcp::socket socket_;
     /// room associated with participant
@@ -223,6 +134,8 @@ private:
     chat_message read_msg_;
     /// local cantainer for the send messages
     std::deque<chat_message> write_msgs_;
+    /// buffers of the messages that are being written
+    std::vector<boost::asio::const_buffer> write_bufs_;
 };
 
 //----------------------------------------------------------------------
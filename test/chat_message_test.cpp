@@ -0,0 +1,88 @@
+#include <string>
+#include "test.hpp"
+#include "../include/chat_message.hpp"
+
+/**
+@file chat_message_test.cpp
+chat_message codec tests
+*/
+
+/// copies header string to the message and decodes it
+static bool decode(chat_message &msg, const char *header) {
+    std::memcpy(msg.data(), header, chat_message::header_length);
+    return msg.decode_header();
+}
+
+/// encode/decode round trip preserves body, nickname and type
+static void test_round_trip() {
+    chat_message msg = create_msg("hello", "alice", MESSAGE);
+    CHECK(std::string(msg.data(), chat_message::header_length) == "000505");
+    CHECK(msg.length() == chat_message::header_length + chat_message::type_length
+          + chat_message::max_nick_length + 5);
+
+    chat_message read;
+    std::memcpy(read.data(), msg.data(), msg.length());
+    CHECK(read.decode_header());
+    CHECK(read.body_length() == 5);
+    CHECK(read.nick_length() == 5);
+    CHECK(*(read.type()) == MESSAGE);
+    CHECK(std::string(read.body(), read.body_length()) == "hello");
+    CHECK(std::string(read.nick(), read.nick_length()) == "alice");
+}
+
+/// empty body and nickname, as in the server negative reply
+static void test_empty() {
+    chat_message msg = create_msg("", "", NEGATIVE);
+    CHECK(std::string(msg.data(), chat_message::header_length) == "000000");
+    chat_message read;
+    std::memcpy(read.data(), msg.data(), msg.length());
+    CHECK(read.decode_header());
+    CHECK(read.body_length() == 0);
+    CHECK(read.nick_length() == 0);
+    CHECK(*(read.type()) == NEGATIVE);
+}
+
+/// body and nickname longer than maximum are truncated
+static void test_truncation() {
+    std::string body(chat_message::max_body_length + 10, 'b');
+    std::string nick(chat_message::max_nick_length + 3, 'n');
+    chat_message msg = create_msg(body.c_str(), nick.c_str(), MESSAGE);
+    CHECK(msg.body_length() == chat_message::max_body_length);
+    CHECK(msg.nick_length() == chat_message::max_nick_length);
+
+    chat_message read;
+    std::memcpy(read.data(), msg.data(), msg.length());
+    CHECK(read.decode_header());
+    CHECK(read.body_length() == chat_message::max_body_length);
+    CHECK(read.nick_length() == chat_message::max_nick_length);
+}
+
+/// boundary lengths are accepted, exceeding ones are rejected
+static void test_malformed_headers() {
+    chat_message msg;
+    CHECK(decode(msg, "102416"));
+    CHECK(msg.body_length() == 1024);
+    CHECK(msg.nick_length() == 16);
+
+    CHECK(!decode(msg, "102500"));
+    CHECK(msg.body_length() == 0);
+    CHECK(!decode(msg, "000017"));
+    CHECK(msg.body_length() == 0);
+    CHECK(!decode(msg, "000099"));
+    CHECK(!decode(msg, "999999"));
+
+    // non numeric header is parsed as far as atoi goes
+    CHECK(decode(msg, "xyzabc"));
+    CHECK(msg.body_length() == 0);
+    CHECK(msg.nick_length() == 0);
+    CHECK(decode(msg, "12\0\0\0\0"));
+    CHECK(msg.body_length() == 0);
+    CHECK(msg.nick_length() == 12);
+}
+
+void test_chat_message() {
+    test_round_trip();
+    test_empty();
+    test_truncation();
+    test_malformed_headers();
+}
@@ -0,0 +1,98 @@
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "../include/chat_room.hpp"
+
+/**
+@file chat_room_test.cpp
+chat_room tests with mock participants
+*/
+
+/**
+@class mock_participant
+participant that stores delivered messages
+*/
+class mock_participant : public chat_participant {
+public:
+    /// stores delivered message
+    void deliver(const chat_message &msg) {
+        msgs.push_back(msg);
+    }
+
+    /// delivered messages
+    std::vector<chat_message> msgs;
+};
+
+/// every joined participant receives broadcast message
+static void test_fan_out() {
+    chat_room room;
+    std::vector<std::shared_ptr<mock_participant> > ps;
+    for (int i = 0; i < 5; ++i) {
+        ps.push_back(std::make_shared<mock_participant>());
+        room.join(ps.back());
+    }
+    room.deliver(create_msg("hi", "bob", MESSAGE));
+    for (auto &p: ps) {
+        CHECK(p->msgs.size() == 1);
+        CHECK(std::string(p->msgs[0].body(), p->msgs[0].body_length()) == "hi");
+    }
+
+    room.leave(ps[0]);
+    room.deliver(create_msg("bye", "bob", MESSAGE));
+    CHECK(ps[0]->msgs.size() == 1);
+    CHECK(ps[1]->msgs.size() == 2);
+}
+
+/// nickname is reserved until its owner leaves, history is replayed on success
+static void test_nicknames_and_history() {
+    chat_room room;
+    auto a = std::make_shared<mock_participant>();
+    auto b = std::make_shared<mock_participant>();
+    room.join(a);
+    room.join(b);
+    room.deliver(create_msg("one", "x", MESSAGE));
+    room.deliver(create_msg("two", "x", MESSAGE));
+
+    a->msgs.clear();
+    CHECK(room.is_available(create_msg("", "alice", QUERY), a));
+    CHECK(a->msgs.size() == 2);
+    CHECK(std::string(a->msgs[1].body(), a->msgs[1].body_length()) == "two");
+
+    b->msgs.clear();
+    CHECK(!room.is_available(create_msg("", "alice", QUERY), b));
+    CHECK(b->msgs.empty());
+
+    room.leave(a);
+    CHECK(room.is_available(create_msg("", "alice", QUERY), b));
+}
+
+/// history keeps only the most recent messages
+static void test_history_limit() {
+    chat_room room;
+    for (int i = 0; i < 150; ++i) {
+        room.deliver(create_msg(std::to_string(i).c_str(), "x", MESSAGE));
+    }
+    auto p = std::make_shared<mock_participant>();
+    room.join(p);
+    CHECK(room.is_available(create_msg("", "p", QUERY), p));
+    CHECK(p->msgs.size() == 100);
+    CHECK(std::string(p->msgs.front().body(), p->msgs.front().body_length()) == "50");
+    CHECK(std::string(p->msgs.back().body(), p->msgs.back().body_length()) == "149");
+}
+
+/// participant without nickname can leave
+static void test_leave_without_nick() {
+    chat_room room;
+    auto p = std::make_shared<mock_participant>();
+    room.join(p);
+    room.leave(p);
+    room.deliver(create_msg("hi", "x", MESSAGE));
+    CHECK(p->msgs.empty());
+}
+
+void test_chat_room() {
+    test_fan_out();
+    test_nicknames_and_history();
+    test_history_limit();
+    test_leave_without_nick();
+}
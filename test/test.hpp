@@ -0,0 +1,24 @@
+#pragma once
+#include <iostream>
+
+/**
+@file test.hpp
+minimal check macro shared by the test translation units
+*/
+
+/// number of failed checks
+extern int failed_checks;
+
+/// checks condition and reports it with its location if it is false
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            ++failed_checks; \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+        } \
+    } while (0)
+
+/// chat_message codec tests
+void test_chat_message();
+/// chat_room tests
+void test_chat_room();
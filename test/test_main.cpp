@@ -0,0 +1,24 @@
+#include "test.hpp"
+
+/**
+@file test_main.cpp
+runs all tests
+*/
+
+int failed_checks = 0;
+
+/**
+@function main
+runs all tests, returns non zero if any check failed
+*/
+int main() {
+    test_chat_message();
+    test_chat_room();
+
+    if (failed_checks) {
+        std::cerr << failed_checks << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "all tests passed\n";
+    return 0;
+}